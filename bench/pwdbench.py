@@ -0,0 +1,662 @@
+#!/usr/bin/env python3
+#------------------------------------------------------------------------------+
+#                                                                              |
+# filename: pwdbench.py                                                        |
+# project:  ZX Spectrum Next - P(rint)W(orking)D(irectory)                     |
+# author:   Stefan Zell                                                        |
+# date:     10/19/2026                                                         |
+#                                                                              |
+#------------------------------------------------------------------------------+
+#                                                                              |
+# description:                                                                 |
+#                                                                              |
+# Headless end-to-end benchmark (Linux): measures the T-states needed to load  |
+# the dot command from "/dot" and to run "main()" on an emulated ZX Spectrum   |
+# Next (ZEsarUX, remote protocol "ZRCP").                                      |
+#                                                                              |
+#------------------------------------------------------------------------------+
+#                                                                              |
+# Copyright (c) 10/19/2026 STZ Engineering                                     |
+#                                                                              |
+# This software is provided  "as is",  without warranty of any kind, express   |
+# or implied. In no event shall STZ or its contributors be held liable for any |
+# direct, indirect, incidental, special or consequential damages arising out   |
+# of the use of or inability to use this software.                             |
+#                                                                              |
+# Permission is granted to anyone  to use this  software for any purpose,      |
+# including commercial applications,  and to alter it and redistribute it      |
+# freely, subject to the following restrictions:                               |
+#                                                                              |
+# 1. Redistributions of source code must retain the above copyright            |
+#    notice, definition, disclaimer, and this list of conditions.              |
+#                                                                              |
+# 2. Redistributions in binary form must reproduce the above copyright         |
+#    notice, definition, disclaimer, and this list of conditions in            |
+#    documentation and/or other materials provided with the distribution.      |
+#                                                                          ;-) |
+#------------------------------------------------------------------------------+
+
+"""
+Headless load-and-run benchmark of the dot command "pwd".
+
+1. A copy of a bootable NextZXOS disk image (e.g. "tbblue.mmc" of ZEsarUX) is
+   extended with "hdfmonkey": the dot command is copied to "/dot/PWD", a
+   synthetic directory tree "/PWD01/PWD02/..." is created and an
+   "AUTOEXEC.BAS" makes NextZXOS start directly into NextBASIC.
+
+2. ZEsarUX is started without video/audio and controlled via its remote
+   protocol. Readiness of the editor is detected by polling the screen (OCR).
+   For every directory depth the cwd is changed with "CD" and verified with an
+   unmeasured ".pwd", then ".pwd" is entered with every option set:
+
+   - the T-state counter is reset when ENTER is pressed ("command entry");
+     ENTER is released after two frame interrupts,
+   - a breakpoint on the entry of the dot command (0x2000) gives the load
+     time ("load_tstates"); the CPU speed of NextZXOS is read from NextReg
+     0x07 there and the load time is converted to microseconds ("load_us"),
+   - a breakpoint on the return address of the dot command gives the run
+     time ("run_tstates"); the carry flag must be clear (no error),
+   - the total from command entry to return is given in T-states
+     ("total_tstates") and in microseconds ("total_us").
+
+3. The results are written to a JSON file. With "--baseline" the results of
+   another run (e.g. of the last release) are compared to the current one.
+
+All values are emulated, so the wall clock speed of the host has no influence.
+The phases run at different CPU speeds, so "total_tstates" is not proportional
+to time: "total_us" converts "load" with the measured speed and "run" with
+RUN_MHZ ("run_mhz"). The CRT startup before "_construct()" and the exit after
+"_destruct()" run at the speed of the caller; "total_us" is too low by their
+share of "run_tstates" (small, but not zero if NextZXOS runs at 3.5 MHz).
+"""
+
+import argparse
+import datetime
+import json
+import os
+import re
+import shutil
+import socket
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+#==============================================================================#
+#                               Constants                                      #
+#==============================================================================#
+
+#: Root of the repository (this file lives in "<root>/bench")
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+#: Address where NextZXOS loads and starts dot commands
+DOT_ENTRY = 0x2000
+
+#: Name of the directories of the synthetic tree ("/PWD01/PWD02/...")
+BENCH_DIR = "PWD%02d"
+
+#: Directory depths (number of path components) to measure; "0" is "/"
+DEFAULT_DEPTHS = [0, 1, 2, 4, 8, 16]
+
+#: Maximum depth ("/PWDnn" * 32 fits into ESX_PATHNAME_MAX)
+MAX_DEPTH = 32
+
+#: Option sets of ".pwd" to measure
+DEFAULT_OPTIONS = ["", "-h", "-v", "--help", "--version"]
+
+#: Key code of ENTER for the ZRCP command "send-keys-event"
+KEY_ENTER = 13
+
+#: Frame interrupts (IM 1, 0x0038) ENTER is held down; far below the ROM's
+#: auto repeat delay (REPDEL)
+KEY_HOLD_FRAMES = 2
+
+#: CPU speed in MHz by NextReg 0x07 (bits 1..0)
+CPU_MHZ = [3.5, 7.0, 14.0, 28.0]
+
+#: CPU speed assumed for "run" ("_construct()" switches to 28 MHz)
+RUN_MHZ = 28.0
+
+#: Report line of NextBASIC (e.g. "0 OK, 0:1")
+REPORT_LINE = re.compile(r", \d+:\d+\s*$")
+
+#: Interval (seconds) to poll the screen
+POLL_INTERVAL = 0.1
+
+#: Prompts of ZRCP (normal and cpu-step mode)
+ZRCP_PROMPT = re.compile(rb"command(@cpu-step)?> $")
+
+#==============================================================================#
+#                               Disk image                                     #
+#==============================================================================#
+
+def basicLine(iNumber, abBody):
+  """
+  Returns one tokenized line of a BASIC program.
+  """
+  abBody = abBody + b"\x0D"
+  return iNumber.to_bytes(2, "big") + len(abBody).to_bytes(2, "little") + abBody
+
+
+def plus3dosFile(abProgram, iAutostart):
+  """
+  Returns a BASIC program with +3DOS header (128 bytes).
+  """
+  abHeader = bytearray(128)
+  abHeader[0:8]   = b"PLUS3DOS"
+  abHeader[8]     = 0x1A                                    # soft-EOF
+  abHeader[9]     = 0x01                                    # issue
+  abHeader[10]    = 0x00                                    # version
+  abHeader[11:15] = (128 + len(abProgram)).to_bytes(4, "little")
+  abHeader[15]    = 0x00                                    # type: program
+  abHeader[16:18] = len(abProgram).to_bytes(2, "little")
+  abHeader[18:20] = iAutostart.to_bytes(2, "little")
+  abHeader[20:22] = len(abProgram).to_bytes(2, "little")    # no variables
+  abHeader[127]   = sum(abHeader[0:127]) & 0xFF
+  return bytes(abHeader) + abProgram
+
+
+def benchPath(iDepth):
+  """
+  Returns the path of the directory with the given depth.
+  """
+  if 0 == iDepth:
+    return "/"
+  return "".join("/" + BENCH_DIR % i for i in range(1, iDepth + 1))
+
+
+def hdfmonkey(tArgs, sImage, *tParams):
+  """
+  Executes one command of "hdfmonkey" on the disk image.
+  """
+  subprocess.run([tArgs.hdfmonkey, tParams[0], sImage] + list(tParams[1:]),
+                 check = True, stdout = subprocess.DEVNULL)
+
+
+def buildImage(tArgs, sWorkDir):
+  """
+  Creates the disk image of the benchmark and returns its filename.
+  """
+  sImage = os.path.join(sWorkDir, "pwdbench.mmc")
+  shutil.copyfile(tArgs.base_image, sImage)
+
+  hdfmonkey(tArgs, sImage, "put", tArgs.dot, "/dot/PWD")
+
+  # "10 REM": program ends with "0 OK" in the editor of NextBASIC
+  sAutoexec = os.path.join(sWorkDir, "AUTOEXEC.BAS")
+  with open(sAutoexec, "wb") as hFile:
+    hFile.write(plus3dosFile(basicLine(10, b"\xEA pwdbench"), 10))
+  hdfmonkey(tArgs, sImage, "put", sAutoexec, "/nextzxos/autoexec.bas")
+
+  # all depths are prefixes of the deepest path
+  sPath = ""
+  for sDir in benchPath(max(tArgs.depths)).strip("/").split("/"):
+    if sDir:
+      sPath += "/" + sDir
+      hdfmonkey(tArgs, sImage, "mkdir", sPath)
+
+  return sImage
+
+#==============================================================================#
+#                               Emulator                                       #
+#==============================================================================#
+
+class Zrcp:
+  """
+  Minimal client of the ZEsarUX remote protocol.
+  """
+
+  def __init__(self, iPort, fTimeout):
+    fLimit = time.monotonic() + fTimeout
+    while True:
+      try:
+        self.hSocket = socket.create_connection(("127.0.0.1", iPort), 5.0)
+        break
+      except OSError:
+        if time.monotonic() > fLimit:
+          raise TimeoutError("ZRCP port %d not reachable within %.0f s" % (iPort, fTimeout))
+        time.sleep(0.5)
+    self.hSocket.settimeout(fTimeout)
+    self._read()
+
+  def _read(self):
+    abData = b""
+    while not ZRCP_PROMPT.search(abData):
+      abChunk = self.hSocket.recv(4096)
+      if not abChunk:
+        raise ConnectionError("ZRCP connection closed")
+      abData += abChunk
+    return ZRCP_PROMPT.sub(b"", abData).decode("latin-1").strip()
+
+  def cmd(self, sCommand):
+    """
+    Sends one command and returns its output (without prompt).
+    """
+    self.hSocket.sendall(sCommand.encode("latin-1") + b"\n")
+    sOutput = self._read()
+    if re.match(r"error", sOutput, re.IGNORECASE):
+      raise RuntimeError("ZRCP '%s': %s" % (sCommand, sOutput))
+    return sOutput
+
+  def register(self, sName):
+    """
+    Returns the value of a 16 bit register.
+    """
+    tMatch = re.search(r"\b%s=([0-9a-fA-F]{4})" % sName, self.cmd("get-registers"))
+    if tMatch is None:
+      raise RuntimeError("register %s not found in 'get-registers'" % sName)
+    return int(tMatch.group(1), 16)
+
+  def nextreg(self, iRegister):
+    """
+    Returns the value of a NextReg.
+    """
+    tMatch = re.search(r"\b(?:0x)?([0-9a-fA-F]+)(H?)\s*$",
+                       self.cmd("tbblue-get-register %d" % iRegister))
+    if tMatch is None:
+      raise RuntimeError("NextReg 0x%02X not readable" % iRegister)
+    bHex = tMatch.group(2) or re.search(r"[a-fA-F]", tMatch.group(1))
+    return int(tMatch.group(1), 16 if bHex else 10)
+
+  def memory(self, iAddress, iLength):
+    """
+    Returns "iLength" bytes of memory from the given address.
+    """
+    sHex = re.sub(r"[^0-9a-fA-F]", "", self.cmd("read-memory %d %d" % (iAddress, iLength)))
+    return bytes.fromhex(sHex[:iLength * 2])
+
+  def tstates(self):
+    """
+    Returns the partial T-state counter.
+    """
+    return int(re.search(r"\d+", self.cmd("get-tstates-partial")).group(0))
+
+  def screen(self):
+    """
+    Returns the (non empty) lines of the screen as recognized by OCR.
+    """
+    return [sLine.rstrip() for sLine in self.cmd("get-ocr").splitlines() if sLine.strip()]
+
+  def runTo(self, sCondition, fCheck, iLimit = 1000):
+    """
+    Runs until the breakpoint with the given condition is hit and "fCheck"
+    returns "True".
+    """
+    self.cmd("set-breakpoint 1 %s" % sCondition)
+    for _ in range(iLimit):
+      self.cmd("run")
+      if fCheck():
+        return
+    raise RuntimeError("breakpoint '%s' not reached" % sCondition)
+
+  def close(self):
+    try:
+      self.hSocket.sendall(b"exit-emulator\n")
+    except OSError:
+      pass
+    self.hSocket.close()
+
+
+def startEmulator(tArgs, sImage):
+  """
+  Starts ZEsarUX (headless) with the given disk image.
+  """
+  tCommand = [tArgs.zesarux,
+              "--noconfigfile", "--nosplash", "--quickexit",
+              "--machine", "tbblue",
+              "--vo", "null", "--ao", "null",
+              "--enable-mmc", "--enable-divmmc-ports", "--mmc-file", sImage,
+              "--enable-remoteprotocol", "--remoteprotocol-port", str(tArgs.port)]
+  tCommand += tArgs.emulator_arg or []
+  return subprocess.Popen(tCommand, stdout = subprocess.DEVNULL, stderr = subprocess.DEVNULL)
+
+
+def waitScreen(tZrcp, fCheck, fTimeout, sWhat):
+  """
+  Polls the screen until "fCheck" returns "True" and returns the lines.
+  """
+  fLimit = time.monotonic() + fTimeout
+  while True:
+    tLines = tZrcp.screen()
+    if fCheck(tLines):
+      return tLines
+    if time.monotonic() > fLimit:
+      raise TimeoutError("timeout (%.0f s) waiting for %s; screen: %s"
+                         % (fTimeout, sWhat, " | ".join(tLines) or "<empty>"))
+    time.sleep(POLL_INTERVAL)
+
+
+def isReport(tLines):
+  return bool(tLines) and bool(REPORT_LINE.search(tLines[-1]))
+
+
+def waitReport(tZrcp, fTimeout, sWhat):
+  """
+  Waits until NextBASIC shows a report; aborts on every report but "0 OK".
+  """
+  tLines = waitScreen(tZrcp, isReport, fTimeout, sWhat)
+  if not tLines[-1].lstrip().startswith("0 OK"):
+    raise RuntimeError("%s failed: %s" % (sWhat, tLines[-1].strip()))
+  return tLines
+
+
+def typeText(tZrcp, sText, fTimeout):
+  """
+  Types the given text into the editor of NextBASIC (without ENTER) and waits
+  until it is shown in the editor.
+  """
+  tZrcp.cmd("send-keys-ascii 30 %s" % " ".join(str(ord(c)) for c in sText))
+  waitScreen(tZrcp,
+             lambda tLines: not isReport(tLines) and sText.lower() in "".join(tLines).lower(),
+             fTimeout, "editor input '%s'" % sText)
+
+
+def pressEnter(tZrcp):
+  """
+  Presses ENTER and releases it after KEY_HOLD_FRAMES frame interrupts. The
+  emulator has to be in cpu-step mode.
+  """
+  tZrcp.cmd("send-keys-event %d 1" % KEY_ENTER)
+  tZrcp.runTo("PC=0038H", lambda: True)
+  for _ in range(KEY_HOLD_FRAMES - 1):
+    tZrcp.cmd("run")
+  tZrcp.cmd("send-keys-event %d 0" % KEY_ENTER)
+
+
+def execute(tZrcp, sCommand, fTimeout):
+  """
+  Executes one (unmeasured) command and returns the lines of the screen
+  without the report.
+  """
+  typeText(tZrcp, sCommand, fTimeout)
+  tZrcp.cmd("enter-cpu-step")
+  tZrcp.cmd("enable-breakpoints")
+  pressEnter(tZrcp)
+  tZrcp.cmd("disable-breakpoints")
+  tZrcp.cmd("exit-cpu-step")
+  return waitReport(tZrcp, fTimeout, "'%s'" % sCommand)[:-1]
+
+
+def changeDir(tZrcp, sPath, fTimeout):
+  """
+  Changes the cwd and verifies it with an (unmeasured) ".pwd".
+  """
+  execute(tZrcp, "CLS", fTimeout)
+  execute(tZrcp, 'CD "%s"' % sPath, fTimeout)
+  execute(tZrcp, "CLS", fTimeout)
+  checkCwd(execute(tZrcp, ".pwd", fTimeout), sPath)
+
+
+def checkCwd(tLines, sPath):
+  """
+  Aborts if the output of ".pwd" is not the given path.
+  """
+  sOutput = "".join(sLine.strip() for sLine in tLines)
+  if "/" == sPath:
+    # normalizepath(): "/" => "/.", "X:/" => "X:"
+    sExpected = "/."
+    sPattern  = r"(?:[A-Za-z]:)?/\.|[A-Za-z]:"
+  else:
+    sExpected = sPath
+    sPattern  = r"(?:[A-Za-z]:)?" + re.escape(sPath)
+  if not re.fullmatch(sPattern, sOutput, re.IGNORECASE):
+    raise RuntimeError("cwd is '%s', expected '%s'" % (sOutput, sExpected))
+
+
+def measure(tZrcp, sArgs, abSignature, fTimeout):
+  """
+  Measures one execution of ".pwd <sArgs>" and returns the results and the
+  output on the screen.
+  """
+  sCommand = (".pwd " + sArgs).strip()
+  execute(tZrcp, "CLS", fTimeout)
+  typeText(tZrcp, sCommand, fTimeout)
+
+  tZrcp.cmd("enter-cpu-step")
+  tZrcp.cmd("enable-breakpoints")
+  tZrcp.cmd("reset-tstates-partial")
+  pressEnter(tZrcp)
+
+  # 0x2000 is used by esxDOS too: only accept the entry of the loaded dot
+  tZrcp.runTo("PC=%04XH" % DOT_ENTRY,
+              lambda: tZrcp.memory(DOT_ENTRY, len(abSignature)) == abSignature)
+  iLoad = tZrcp.tstates()
+  fMhz = CPU_MHZ[tZrcp.nextreg(0x07) & 0x03]
+
+  iSp = tZrcp.register("SP")
+  iReturn = int.from_bytes(tZrcp.memory(iSp, 2), "little")
+  tZrcp.runTo("PC=%04XH" % iReturn, lambda: tZrcp.register("SP") == iSp + 2)
+  iRun = tZrcp.tstates() - iLoad
+
+  # dot commands return with carry set in case of an error
+  if tZrcp.register("AF") & 0x01:
+    raise RuntimeError("'%s' returned an error" % sCommand)
+
+  tZrcp.cmd("disable-breakpoints")
+  tZrcp.cmd("exit-cpu-step")
+  tLines = waitReport(tZrcp, fTimeout, "'%s'" % sCommand)
+
+  return ({"load_tstates": iLoad,
+           "load_mhz":     fMhz,
+           "load_us":       int(iLoad / fMhz),
+           "run_tstates":   iRun,
+           "run_mhz":       RUN_MHZ,
+           "total_tstates": iLoad + iRun,
+           "total_us":      int(iLoad / fMhz + iRun / RUN_MHZ)},
+          tLines[:-1])
+
+#==============================================================================#
+#                               Results                                        #
+#==============================================================================#
+
+def appVersion():
+  """
+  Returns the version of the application (from "inc/version.h").
+  """
+  tValues = {}
+  with open(os.path.join(REPO_DIR, "inc", "version.h")) as hFile:
+    for sLine in hFile:
+      tMatch = re.match(r"#define\s+FILE_VERSION_(MAJOR|MINOR|PATCH)\s+(\d+)", sLine)
+      if tMatch:
+        tValues[tMatch.group(1)] = tMatch.group(2)
+  return "%s.%s.%s" % (tValues["MAJOR"], tValues["MINOR"], tValues["PATCH"])
+
+
+def gitRevision():
+  """
+  Returns the current git revision of the repository (or "None").
+  """
+  try:
+    return subprocess.run(["git", "-C", REPO_DIR, "describe", "--always", "--dirty"],
+                          check = True, capture_output = True, text = True).stdout.strip()
+  except (OSError, subprocess.CalledProcessError):
+    return None
+
+
+def caseKey(tCase):
+  return "%d:%s" % (tCase["depth"], tCase["args"])
+
+
+def delta(iOld, iNew):
+  """
+  Returns the relative difference as text.
+  """
+  return "%+7.1f%%" % (100.0 * (iNew - iOld) / iOld) if iOld else "    n/a"
+
+
+def compare(tResults, sBaseline):
+  """
+  Prints the difference of the median load and run times to the given result
+  file.
+  """
+  with open(sBaseline) as hFile:
+    tBase = {caseKey(t): t for t in json.load(hFile).get("cases", [])}
+
+  print("\n%-6s %-10s %10s %10s %8s %12s %12s %8s %10s %10s %8s"
+        % ("depth", "args", "load(us)", "base", "delta", "run(T)", "base", "delta",
+           "total(us)", "base", "delta"))
+  for tCase in tResults["cases"]:
+    tOld = tBase.get(caseKey(tCase))
+    if (tOld is None) or ("total_us" not in tOld["median"]):
+      continue
+    tOld = tOld["median"]
+    tNew = tCase["median"]
+    print("%-6d %-10s %10d %10d %s %12d %12d %s %10d %10d %s"
+          % (tCase["depth"], tCase["args"] or "-",
+             tNew["load_us"], tOld["load_us"], delta(tOld["load_us"], tNew["load_us"]),
+             tNew["run_tstates"], tOld["run_tstates"], delta(tOld["run_tstates"], tNew["run_tstates"]),
+             tNew["total_us"], tOld["total_us"], delta(tOld["total_us"], tNew["total_us"])))
+
+#==============================================================================#
+#                               Main                                           #
+#==============================================================================#
+
+def depthList(sValue):
+  """
+  Converts the argument "--depths" to a list of depths (duplicates removed).
+  """
+  try:
+    tDepths = [int(s) for s in sValue.split(",")]
+  except ValueError:
+    raise argparse.ArgumentTypeError("invalid depth list: '%s'" % sValue)
+  for iDepth in tDepths:
+    if not (0 <= iDepth <= MAX_DEPTH):
+      raise argparse.ArgumentTypeError("depth %d not in 0..%d" % (iDepth, MAX_DEPTH))
+  return list(dict.fromkeys(tDepths))
+
+
+def parseArguments():
+  tParser = argparse.ArgumentParser(description = __doc__.strip().splitlines()[0])
+  tParser.add_argument("--base-image", required = True,
+                       help = "bootable NextZXOS disk image (e.g. tbblue.mmc of ZEsarUX)")
+  tParser.add_argument("--dot", default = None,
+                       help = "dot command to measure (default: build/PWD)")
+  tParser.add_argument("--output", default = "pwdbench.json",
+                       help = "result file (JSON; default: pwdbench.json)")
+  tParser.add_argument("--baseline", default = None,
+                       help = "result file of an older run to compare with")
+  tParser.add_argument("--depths", default = DEFAULT_DEPTHS, type = depthList,
+                       help = "comma separated directory depths (0..%d)" % MAX_DEPTH)
+  tParser.add_argument("--options", default = None, action = "append",
+                       help = "option set of .pwd (repeatable; default: all); "
+                              "write options with leading '-' as --options=-v")
+  tParser.add_argument("--runs", default = 5, type = int,
+                       help = "measurements per case")
+  tParser.add_argument("--zesarux", default = "zesarux", help = "emulator executable")
+  tParser.add_argument("--hdfmonkey", default = "hdfmonkey", help = "hdfmonkey executable")
+  tParser.add_argument("--port", default = 10000, type = int, help = "ZRCP port")
+  tParser.add_argument("--boot-timeout", default = 120.0, type = float,
+                       help = "seconds to wait for NextBASIC after start of the emulator")
+  tParser.add_argument("--timeout", default = 30.0, type = float,
+                       help = "seconds to wait for the editor after each command")
+  tParser.add_argument("--emulator-arg", action = "append",
+                       help = "additional argument for the emulator (repeatable)")
+  tParser.add_argument("--keep", action = "store_true",
+                       help = "keep the working directory (disk image)")
+
+  tArgs = tParser.parse_args()
+
+  if tArgs.dot is None:
+    for sName in ("PWD", "pwd"):
+      tArgs.dot = os.path.join(REPO_DIR, "build", sName)
+      if os.path.isfile(tArgs.dot):
+        break
+
+  if tArgs.options is None:
+    tArgs.options = DEFAULT_OPTIONS
+  tArgs.options = list(dict.fromkeys(tArgs.options))
+
+  if not os.path.isfile(tArgs.base_image):
+    tParser.error("disk image not found: '%s'" % tArgs.base_image)
+  if not os.path.isfile(tArgs.dot):
+    tParser.error("dot command not found: '%s' (build it first or use --dot)" % tArgs.dot)
+  if (tArgs.baseline is not None) and not os.path.isfile(tArgs.baseline):
+    tParser.error("baseline not found: '%s'" % tArgs.baseline)
+  if 1 > tArgs.runs:
+    tParser.error("--runs must be at least 1")
+  if (0.0 >= tArgs.boot_timeout) or (0.0 >= tArgs.timeout):
+    tParser.error("timeouts must be greater than 0")
+
+  return tArgs
+
+
+def main():
+  tArgs = parseArguments()
+
+  with open(tArgs.dot, "rb") as hFile:
+    abSignature = hFile.read(8)
+
+  sWorkDir = tempfile.mkdtemp(prefix = "pwdbench-")
+  hEmulator = None
+  tZrcp = None
+
+  try:
+    sImage = buildImage(tArgs, sWorkDir)
+
+    hEmulator = startEmulator(tArgs, sImage)
+    tZrcp = Zrcp(tArgs.port, tArgs.boot_timeout)
+    waitReport(tZrcp, tArgs.boot_timeout, "boot of NextZXOS")
+
+    tResults = {
+      "application": "pwd",
+      "version":     appVersion(),
+      "revision":    gitRevision(),
+      "date":        datetime.datetime.now(datetime.timezone.utc).isoformat(),
+      "emulator":    tZrcp.cmd("get-version"),
+      "dot_size":    os.path.getsize(tArgs.dot),
+      "cases":       []
+    }
+
+    for iDepth in tArgs.depths:
+      sPath = benchPath(iDepth)
+      changeDir(tZrcp, sPath, tArgs.timeout)
+
+      for sArgs in tArgs.options:
+        tRuns = []
+        for _ in range(tArgs.runs):
+          tRun, tLines = measure(tZrcp, sArgs, abSignature, tArgs.timeout)
+          if not sArgs:
+            checkCwd(tLines, sPath)
+          tRuns.append(tRun)
+
+        tCase = {
+          "depth":  iDepth,
+          "path":   sPath,
+          "args":   sArgs,
+          "runs":   tRuns,
+          "min":    {k: min(t[k] for t in tRuns) for k in tRuns[0]},
+          "median": {k: statistics.median(t[k] for t in tRuns) for k in tRuns[0]}
+        }
+        tResults["cases"].append(tCase)
+        print("depth %2d  %-10s load %9d us (%4.1f MHz)  run %9d T  total %9d us"
+              % (iDepth, sArgs or "-", tCase["median"]["load_us"],
+                 tCase["median"]["load_mhz"], tCase["median"]["run_tstates"],
+                 tCase["median"]["total_us"]))
+
+    with open(tArgs.output, "w") as hFile:
+      json.dump(tResults, hFile, indent = 2)
+      hFile.write("\n")
+    print("results written to %s" % tArgs.output)
+
+    if tArgs.baseline:
+      compare(tResults, tArgs.baseline)
+
+  finally:
+    if tZrcp is not None:
+      tZrcp.close()
+    if hEmulator is not None:
+      try:
+        hEmulator.wait(5)
+      except subprocess.TimeoutExpired:
+        hEmulator.kill()
+    if tArgs.keep:
+      print("working directory: %s" % sWorkDir)
+    else:
+      shutil.rmtree(sWorkDir, ignore_errors = True)
+
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())